@@ -1,6 +1,13 @@
 #include <iostream>
 #include <vector>
 #include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <chrono>
+#include <limits>
+#include <thread>
+#include <mutex>
+#include <atomic>
 using namespace std;
 
 /*
@@ -117,6 +124,680 @@ public:
         O(n!)      → storing all permutations.
 */
 
+/*
+===============================================================
+    Rank / Unrank Engine (Lehmer Code + Fenwick Tree)
+===============================================================
+    Instead of generating the permutations before ours, NUMBER
+    them: rank(p) = how many permutations come before p.
+
+    LEHMER CODE:
+        d[i] = how many UNUSED values are smaller than p[i]
+        rank = d[0]*(n-1)! + d[1]*(n-2)! + ... + d[n-1]*0!
+
+        [2,0,1] of {0,1,2}: d = [2,0,0] → rank 2*2! = 4
+
+    A Fenwick tree over the sorted values marks which values are
+    still unused:
+        rank   → prefix sum "unused values below p[i]"   O(log n)
+        unrank → descend the tree to find the d-th unused O(log n)
+
+    ADVANCE BY k:
+        Add k to the Lehmer digits as a FACTORIAL-BASE number
+        (digit i has base n-i), carrying from the right, then
+        unrank. Overflow past n!-1 wraps to the smallest
+        permutation, exactly like repeated nextPermutation.
+
+    SHARDING:
+        Worker w of W starts at rank floor(n! * w / W) and stops
+        before the next worker's start rank.
+
+    Values must be DISTINCT; ranks fit in 64 bits for n <= 20.
+
+    TIME COMPLEXITY:  O(n log n) for rank, unrank and advance
+    SPACE COMPLEXITY: O(n)
+*/
+
+struct Fenwick {
+    vector<int> t;
+    int LOG = 1;
+
+    explicit Fenwick(int n) : t(n + 1, 0) {
+        while ((1 << LOG) <= n) LOG++;
+    }
+
+    void add(int i, int v) {
+        for (i++; i < (int)t.size(); i += i & -i) t[i] += v;
+    }
+
+    int prefix(int i) const {          // sum of [0, i)
+        int s = 0;
+        for (; i > 0; i -= i & -i) s += t[i];
+        return s;
+    }
+
+    int kth(int k) const {             // smallest index with prefix(index+1) > k
+        int pos = 0;
+        for (int step = 1 << LOG; step; step >>= 1) {
+            if (pos + step < (int)t.size() && t[pos + step] <= k) {
+                pos += step;
+                k -= t[pos];
+            }
+        }
+        return pos;
+    }
+};
+
+class PermutationRanker {
+public:
+    static uint64_t factorial(int n) {
+        uint64_t f = 1;
+        for (int i = 2; i <= n; i++) f *= i;
+        return f;
+    }
+
+    // d[i] = number of unused values smaller than perm[i]
+    static vector<int> lehmer(const vector<int>& perm) {
+        int n = perm.size();
+        vector<int> sorted(perm);
+        sort(sorted.begin(), sorted.end());
+
+        Fenwick unused(n);
+        for (int i = 0; i < n; i++) unused.add(i, 1);
+
+        vector<int> d(n);
+        for (int i = 0; i < n; i++) {
+            int v = lower_bound(sorted.begin(), sorted.end(), perm[i]) - sorted.begin();
+            d[i] = unused.prefix(v);
+            unused.add(v, -1);
+        }
+        return d;
+    }
+
+    // Permutation of sorted values with the given Lehmer digits
+    static vector<int> fromLehmer(const vector<int>& d, const vector<int>& sorted) {
+        int n = sorted.size();
+        Fenwick unused(n);
+        for (int i = 0; i < n; i++) unused.add(i, 1);
+
+        vector<int> perm(n);
+        for (int i = 0; i < n; i++) {
+            int v = unused.kth(d[i]);
+            perm[i] = sorted[v];
+            unused.add(v, -1);
+        }
+        return perm;
+    }
+
+    static uint64_t rank(const vector<int>& perm) {
+        vector<int> d = lehmer(perm);
+        uint64_t r = 0;
+        for (int i = 0; i < (int)d.size(); i++) r = r * (d.size() - i) + d[i];
+        return r;
+    }
+
+    // values may be in any order; rank 0 = ascending
+    static vector<int> unrank(uint64_t r, vector<int> values) {
+        int n = values.size();
+        sort(values.begin(), values.end());
+
+        vector<int> d(n);
+        for (int i = n - 1; i >= 0; i--) {
+            uint64_t base = n - i;
+            d[i] = r % base;
+            r /= base;
+        }
+        return fromLehmer(d, values);
+    }
+
+    // Same result as calling nextPermutation k times (wraps at n!)
+    static void advance(vector<int>& perm, uint64_t k) {
+        int n = perm.size();
+        vector<int> d = lehmer(perm);
+
+        uint64_t carry = k;
+        for (int i = n - 1; i >= 0 && carry; i--) {
+            uint64_t base = n - i;
+            uint64_t t = d[i] + carry % base;
+            carry = carry / base + t / base;
+            d[i] = t % base;
+        }
+
+        vector<int> sorted(perm);
+        sort(sorted.begin(), sorted.end());
+        perm = fromLehmer(d, sorted);
+    }
+
+    // First rank of worker w among W equal slices of n!
+    static uint64_t sliceBegin(int n, uint64_t w, uint64_t W) {
+        return (uint64_t)((unsigned __int128)factorial(n) * w / W);
+    }
+};
+
+/*
+===============================================================
+    Packed Enumerator (n <= 16, Amortised O(1) per Permutation)
+===============================================================
+    For search loops over ALL permutations of a small set, keep
+    the permutation in ONE 64-bit word: element i lives in
+    nibble i (bits 4i .. 4i+3). Copying, hashing and storing a
+    permutation is then a single register move.
+
+    Both modes emit BLOCKS of 6: all orders of 3 positions are
+    written straight-line from one word, and only the step to the
+    next block does real work.
+
+    HEAP MODE (any order, fastest):
+        Heap's algorithm — consecutive permutations differ by ONE
+        swap. Between blocks: one nibble swap plus the counter walk
+        (amortised O(1)).
+
+    LEXICOGRAPHIC MODE (same order as nextPermutation):
+        Between blocks: pivot/successor scans, then the suffix
+        reverse in O(1) — nibble-reverse the whole word (bswap +
+        nibble swap), shift the suffix into place, mask.
+
+    Output goes to a caller buffer in batches, so the caller's
+    loop runs over a flat array with no per-permutation call.
+
+    TIME COMPLEXITY:  O(1) amortised per permutation
+    SPACE COMPLEXITY: O(1) besides the caller's buffer
+*/
+
+class PackedPermutations {
+public:
+    enum Mode { HEAP, LEXICOGRAPHIC };
+
+    PackedPermutations(int n, Mode mode) : n(n), mode(mode), word(identity(n)) {}
+
+    static uint64_t identity(int n) {
+        uint64_t w = 0;
+        for (int i = 0; i < n; i++) w |= (uint64_t)i << (4 * i);
+        return w;
+    }
+
+    static int at(uint64_t w, int i) { return (w >> (4 * i)) & 0xF; }
+
+    static void unpack(uint64_t w, int n, int* out) {
+        for (int i = 0; i < n; i++) out[i] = at(w, i);
+    }
+
+    // Writes up to cap permutations; returns 0 once all n! are out
+    size_t nextBatch(uint64_t* out, size_t cap) {
+        size_t k = 0;
+        uint64_t w = word;              // local: out may alias the member
+        while (k < cap) {
+            if (pendingPos < pendingLen) {
+                out[k++] = pending[pendingPos++];
+            } else if (done) {
+                break;
+            } else if (k + 6 <= cap) {
+                k += nextBlock(out + k, w);
+            } else {
+                pendingLen = nextBlock(pending, w);
+                pendingPos = 0;
+            }
+        }
+        word = w;
+        return k;
+    }
+
+private:
+    int n;
+    Mode mode;
+    uint64_t word;
+    bool started = false, done = false;
+    int c[16] = {};                   // Heap counters for levels >= 3
+    uint64_t pending[6];
+    int pendingPos = 0, pendingLen = 0;
+
+    /*
+        One BLOCK = the 6 orders of the last 3 positions (lexicographic)
+        or of positions 0..2 (Heap), written straight-line. Only the
+        step between blocks scans or walks counters.
+    */
+    int nextBlock(uint64_t* dst, uint64_t& w) {
+
+        if (n < 3) {
+            done = true;
+            dst[0] = w;
+            if (n < 2) return 1;
+            dst[1] = swapNibbles(w, 0, 1);
+            return 2;
+        }
+
+        // The previous block ended with its last 3 positions descending,
+        // so the lexicographic pivot is at n-4 or further left
+        if (started && !(mode == HEAP ? heapAdvance(w) : lexStep(w, n - 4))) {
+            done = true;
+            return 0;
+        }
+        started = true;
+
+        // Six independent ORs instead of a chain of swaps
+        int s = mode == HEAP ? 0 : 4 * (n - 3);
+        uint64_t base = w & ~(0xFFFULL << s);
+        uint64_t x = (w >> s) & 0xF, y = (w >> (s + 4)) & 0xF, z = (w >> (s + 8)) & 0xF;
+        auto put = [&](uint64_t a, uint64_t b, uint64_t c) {
+            return base | ((a | (b << 4) | (c << 8)) << s);
+        };
+
+        if (mode == HEAP) {             // swaps (0,1) (0,2) (0,1) (0,2) (0,1)
+            dst[0] = put(x, y, z);
+            dst[1] = put(y, x, z);
+            dst[2] = put(z, x, y);
+            dst[3] = put(x, z, y);
+            dst[4] = put(y, z, x);
+            dst[5] = w = put(z, y, x);
+        } else {
+            dst[0] = put(x, y, z);
+            dst[1] = put(x, z, y);
+            dst[2] = put(y, x, z);
+            dst[3] = put(y, z, x);
+            dst[4] = put(z, x, y);
+            dst[5] = w = put(z, y, x);
+        }
+        return 6;
+    }
+
+    // Heap's counter walk from level 3 (levels 1, 2 live inside the block)
+    bool heapAdvance(uint64_t& w) {
+        for (int i = 3; i < n; i++) {
+            if (c[i] < i) {
+                w = swapNibbles(w, i & 1 ? c[i] : 0, i);
+                c[i]++;
+                return true;
+            }
+            c[i] = 0;
+        }
+        return false;
+    }
+
+    static uint64_t swapNibbles(uint64_t w, int a, int b) {
+        uint64_t x = ((w >> (4 * a)) ^ (w >> (4 * b))) & 0xF;
+        return w ^ ((x << (4 * a)) | (x << (4 * b)));
+    }
+
+    static uint64_t reverseNibbles(uint64_t w) {
+        w = __builtin_bswap64(w);
+        return ((w >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((w & 0x0F0F0F0F0F0F0F0FULL) << 4);
+    }
+
+    bool lexStep(uint64_t& w, int i) const {
+        while (i >= 0 && at(w, i) >= at(w, i + 1)) i--;
+        if (i < 0) return false;
+
+        int j = n - 1;
+        while (at(w, j) <= at(w, i)) j--;
+        w = swapNibbles(w, i, j);
+
+        // Reverse nibbles [i+1, n): after a full reverse nibble k sits at
+        // 15-k and belongs at n+i-k → shift by n+i-15 nibbles
+        uint64_t suffixMask = (n == 16 ? ~0ULL : (1ULL << (4 * n)) - 1) & ~((1ULL << (4 * (i + 1))) - 1);
+        uint64_t rev = reverseNibbles(w);
+        int shift = n + i - 15;
+        rev = shift >= 0 ? rev << (4 * shift) : rev >> (-4 * shift);
+        w = (w & ~suffixMask) | (rev & suffixMask);
+        return true;
+    }
+};
+
+/*
+===============================================================
+    Parallel Search over All Permutations (Work Stealing)
+===============================================================
+    Score every permutation of 12–14 items on all cores.
+
+    SPLIT BY RANK:
+        Worker w owns ranks [n!*w/T, n!*(w+1)/T). It starts with
+        unrank() (no earlier permutations generated) and then steps
+        with the nextPermutation algorithm, `grain` ranks at a time.
+
+    WORK STEALING:
+        Each worker's remaining range sits behind its own mutex.
+        The owner takes `grain` ranks from the FRONT; an idle
+        worker steals the BACK HALF of the largest remaining range.
+        Ranges stay contiguous, so a stolen piece is again just
+        "unrank then step".
+
+    CALLBACK / REDUCTION:
+        score(perm, stop) → double. Each worker keeps min, max
+        (with the permutation and its rank) and a count; results
+        are merged at the end. Ties go to the smaller rank, so the
+        answer does not depend on thread timing.
+
+    EARLY TERMINATION:
+        score() sets stop = true → every worker quits at its next
+        permutation.
+
+    PREFIX PRUNING:
+        keep(perm, p) is asked about each NEW prefix of length
+        p <= pruneDepth (the step's pivot says which prefixes
+        changed). false → skip the whole subtree: sort the suffix
+        descending and step once; the rank becomes
+        r - r mod (n-p)! + (n-p)!.
+
+    TIME COMPLEXITY:  O(n! / T) steps per thread (amortised O(1)
+                      each) + O(n log n) per stolen piece or pruned subtree
+    SPACE COMPLEXITY: O(n * T)
+*/
+
+struct PermSearchResult {
+    uint64_t visited = 0;
+    double minScore = numeric_limits<double>::infinity();
+    double maxScore = -numeric_limits<double>::infinity();
+    uint64_t minRank = 0, maxRank = 0;
+    vector<int> argMin, argMax;
+    bool stopped = false;
+
+    void take(double v, uint64_t rank, const vector<int>& perm) {
+        visited++;
+        if (v < minScore || (v == minScore && rank < minRank)) {
+            minScore = v; minRank = rank; argMin = perm;
+        }
+        if (v > maxScore || (v == maxScore && rank < maxRank)) {
+            maxScore = v; maxRank = rank; argMax = perm;
+        }
+    }
+
+    void merge(const PermSearchResult& o) {
+        visited += o.visited;
+        stopped |= o.stopped;
+        if (o.visited == 0) return;
+        if (o.minScore < minScore || (o.minScore == minScore && o.minRank < minRank)) {
+            minScore = o.minScore; minRank = o.minRank; argMin = o.argMin;
+        }
+        if (o.maxScore > maxScore || (o.maxScore == maxScore && o.maxRank < maxRank)) {
+            maxScore = o.maxScore; maxRank = o.maxRank; argMax = o.argMax;
+        }
+    }
+};
+
+class ParallelPermutationSearch {
+public:
+    unsigned threads = max(1u, thread::hardware_concurrency());
+    uint64_t grain = 1 << 14;         // ranks taken per lock
+    int pruneDepth = 0;               // ask keep() for prefixes up to this length
+
+    template <class Score>
+    PermSearchResult run(const vector<int>& items, Score score) {
+        return run(items, score, [](const vector<int>&, int) { return true; });
+    }
+
+    template <class Score, class Keep>
+    PermSearchResult run(vector<int> items, Score score, Keep keep) {
+        sort(items.begin(), items.end());
+        int n = items.size();
+        uint64_t total = PermutationRanker::factorial(n);
+
+        fact.assign(n + 1, 1);
+        for (int i = 1; i <= n; i++) fact[i] = fact[i - 1] * i;
+
+        unsigned T = (unsigned)max<uint64_t>(1, min<uint64_t>(threads, total / grain + 1));
+        ranges = vector<Range>(T);
+        for (unsigned w = 0; w < T; w++) {
+            ranges[w].lo = PermutationRanker::sliceBegin(n, w, T);
+            ranges[w].hi = PermutationRanker::sliceBegin(n, w + 1, T);
+        }
+        stop = false;
+
+        vector<PermSearchResult> local(T);
+        vector<thread> pool;
+        for (unsigned w = 0; w < T; w++)
+            pool.emplace_back([&, w] { worker(w, items, score, keep, local[w]); });
+        for (thread& t : pool) t.join();
+
+        PermSearchResult res;
+        for (const PermSearchResult& r : local) res.merge(r);
+        return res;
+    }
+
+private:
+    struct Range {
+        mutex m;
+        uint64_t lo = 0, hi = 0;
+    };
+    vector<Range> ranges;
+    vector<uint64_t> fact;
+    atomic<bool> stop{false};
+
+    // Own front piece, or steal the back half of the largest range
+    bool nextPiece(unsigned w, uint64_t& lo, uint64_t& hi) {
+        {
+            lock_guard<mutex> g(ranges[w].m);
+            Range& r = ranges[w];
+            if (r.lo < r.hi) {
+                lo = r.lo;
+                hi = min(r.hi, r.lo + grain);
+                r.lo = hi;
+                return true;
+            }
+        }
+        while (true) {
+            unsigned victim = w;
+            uint64_t most = 0;
+            for (unsigned v = 0; v < ranges.size(); v++) {
+                lock_guard<mutex> g(ranges[v].m);
+                if (ranges[v].hi - ranges[v].lo > most) {
+                    most = ranges[v].hi - ranges[v].lo;
+                    victim = v;
+                }
+            }
+            if (most == 0) return false;
+
+            {
+                lock_guard<mutex> g(ranges[victim].m);
+                Range& r = ranges[victim];
+                if (r.lo >= r.hi) continue;          // raced with its owner
+                uint64_t mid = r.hi - (r.hi - r.lo + 1) / 2;
+                lo = mid;
+                hi = r.hi;
+                r.hi = mid;
+            }
+            if (hi - lo > grain) {                   // keep the rest stealable
+                lock_guard<mutex> mine(ranges[w].m); // never held with another lock
+                ranges[w].lo = lo + grain;
+                ranges[w].hi = hi;
+                hi = lo + grain;
+            }
+            return true;
+        }
+    }
+
+    // nextPermutation that also reports the pivot (-1 = wrapped)
+    static int step(vector<int>& nums) {
+        int n = nums.size();
+        int idx = n - 2;
+        while (idx >= 0 && nums[idx] >= nums[idx + 1]) idx--;
+        if (idx >= 0) {
+            int j = n - 1;
+            while (nums[j] <= nums[idx]) j--;
+            swap(nums[idx], nums[j]);
+        }
+        reverse(nums.begin() + idx + 1, nums.end());
+        return idx;
+    }
+
+    template <class Score, class Keep>
+    void worker(unsigned w, const vector<int>& items, Score& score, Keep& keep, PermSearchResult& res) {
+        int n = items.size();
+        int depth = min(pruneDepth, n - 1);
+        uint64_t lo, hi;
+
+        while (!stop.load(memory_order_relaxed) && nextPiece(w, lo, hi)) {
+            uint64_t r = lo;
+            vector<int> perm = PermutationRanker::unrank(r, items);
+            int changedFrom = 0;                     // prefixes longer than this are new
+
+            while (r < hi) {
+                // Prefix pruning: first rejected new prefix wins
+                int cut = 0;
+                for (int p = changedFrom + 1; p <= depth; p++) {
+                    if (!keep(perm, p)) { cut = p; break; }
+                }
+                if (cut) {
+                    uint64_t block = fact[n - cut];
+                    r = r - r % block + block;
+                    if (r >= hi) break;
+                    // Last permutation of the subtree, then one step
+                    sort(perm.begin() + cut, perm.end(), greater<int>());
+                    changedFrom = step(perm);
+                    continue;
+                }
+
+                bool halt = false;
+                res.take(score(perm, halt), r, perm);
+                if (halt) stop = true;
+                if (stop.load(memory_order_relaxed)) {
+                    res.stopped = true;
+                    return;
+                }
+
+                r++;
+                changedFrom = step(perm);
+            }
+        }
+    }
+};
+
+/*
+===============================================================
+    Multiset Permutations (Repeated Values)
+===============================================================
+    nextPermutation already skips duplicate orders of equal
+    values. Here we count and number those DISTINCT orders.
+
+    COUNT:
+        n! / (c1! c2! ... ck!)  for value counts c1..ck
+        built as a product of binomials so it never overflows
+        before the final answer does (answers must fit 64 bits).
+
+    RANK (how many distinct orders come before perm):
+        M = number of orders of the remaining values, rem = size.
+        Putting value v first leaves M * c_v / rem orders, so at
+        position i:
+            rank += M * (count of remaining values < perm[i]) / rem
+        A Fenwick tree over the distinct values gives that count
+        in O(log n).
+
+    UNRANK:
+        Same walk backwards: the value at position i is the first
+        v with M * (count <= v) / rem > r → Fenwick descent on
+        floor(r * rem / M).
+
+    SKIP PREFIX p:
+        The next order whose first p values differ = make the
+        suffix [p, n) its LAST order (sort descending), then one
+        nextPermutation. Skips countWithPrefix(perm, p) orders.
+
+    TIME COMPLEXITY:  O(n log n) for every operation
+    SPACE COMPLEXITY: O(n)
+*/
+
+class MultisetPermutations {
+public:
+    // Distinct orders of values (any order)
+    static uint64_t count(const vector<int>& values) {
+        vector<int> distinct, cnt;
+        compress(values, distinct, cnt);
+        return multinomial(cnt);
+    }
+
+    // Distinct orders sharing perm's first p values
+    static uint64_t countWithPrefix(const vector<int>& perm, int p) {
+        return count(vector<int>(perm.begin() + p, perm.end()));
+    }
+
+    static uint64_t rank(const vector<int>& perm) {
+        vector<int> distinct, cnt;
+        compress(perm, distinct, cnt);
+
+        int k = distinct.size();
+        Fenwick left(k);
+        for (int v = 0; v < k; v++) left.add(v, cnt[v]);
+
+        uint64_t M = multinomial(cnt), r = 0;
+        uint64_t rem = perm.size();
+        for (int x : perm) {
+            int v = lower_bound(distinct.begin(), distinct.end(), x) - distinct.begin();
+            r += (unsigned __int128)M * left.prefix(v) / rem;
+            M = (unsigned __int128)M * cnt[v] / rem;
+            cnt[v]--;
+            left.add(v, -1);
+            rem--;
+        }
+        return r;
+    }
+
+    // r-th distinct order of values (wraps modulo count)
+    static vector<int> unrank(uint64_t r, const vector<int>& values) {
+        vector<int> distinct, cnt;
+        compress(values, distinct, cnt);
+
+        int k = distinct.size();
+        Fenwick left(k);
+        for (int v = 0; v < k; v++) left.add(v, cnt[v]);
+
+        uint64_t M = multinomial(cnt);
+        uint64_t rem = values.size();
+        r %= max<uint64_t>(M, 1);
+
+        vector<int> perm;
+        perm.reserve(values.size());
+        for (; rem > 0; rem--) {
+            int v = left.kth((int)((unsigned __int128)r * rem / M));
+            r -= (unsigned __int128)M * left.prefix(v) / rem;
+            M = (unsigned __int128)M * cnt[v] / rem;
+            cnt[v]--;
+            left.add(v, -1);
+            perm.push_back(distinct[v]);
+        }
+        return perm;
+    }
+
+    // Distinct orders still to come after perm
+    static uint64_t remaining(const vector<int>& perm) {
+        return count(perm) - rank(perm) - 1;
+    }
+
+    // Jump to the next order with a different prefix of length p.
+    // Returns false (and wraps to the smallest order) if none exists.
+    static bool skipPrefix(vector<int>& perm, int p) {
+        sort(perm.begin() + p, perm.end(), greater<int>());
+        bool last = is_sorted(perm.begin(), perm.end(), greater<int>());
+        Solution().nextPermutation(perm);
+        return !last;
+    }
+
+private:
+    static void compress(const vector<int>& values, vector<int>& distinct, vector<int>& cnt) {
+        distinct = values;
+        sort(distinct.begin(), distinct.end());
+        cnt.clear();
+        int k = 0;
+        for (size_t i = 0; i < distinct.size(); i++) {
+            if (i == 0 || distinct[i] != distinct[i - 1]) {
+                distinct[k++] = distinct[i];
+                cnt.push_back(0);
+            }
+            cnt.back()++;
+        }
+        distinct.resize(k);
+    }
+
+    // Product of binomials C(total so far, j): exact at every step
+    static uint64_t multinomial(const vector<int>& cnt) {
+        uint64_t res = 1, total = 0;
+        for (int c : cnt) {
+            for (int j = 1; j <= c; j++) {
+                total++;
+                res = (unsigned __int128)res * total / j;
+            }
+        }
+        return res;
+    }
+};
+
 int main() {
     // Example usage:
     vector<int> nums = {1, 2, 3};
@@ -128,5 +809,97 @@ int main() {
     for (int x : nums) cout << x << " ";
     cout << endl;
 
+    // Jump straight into the permutation space
+    vector<int> p = {3, 1, 4, 0, 2};
+    cout << "Rank of 3 1 4 0 2: " << PermutationRanker::rank(p) << endl;
+
+    PermutationRanker::advance(p, 1000);
+    cout << "1000 steps later : ";
+    for (int x : p) cout << x << " ";
+    cout << endl;
+
+    vector<int> items = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    for (uint64_t w = 0; w < 4; w++) {
+        uint64_t r = PermutationRanker::sliceBegin(items.size(), w, 4);
+        cout << "Worker " << w << " starts at rank " << r << ": ";
+        for (int x : PermutationRanker::unrank(r, items)) cout << x << " ";
+        cout << endl;
+    }
+
+    // Throughput: all 11! permutations, vector nextPermutation vs packed
+    const int N = 11;
+    uint64_t total = PermutationRanker::factorial(N);
+
+    auto t0 = chrono::steady_clock::now();
+    vector<int> v(N);
+    for (int i = 0; i < N; i++) v[i] = i;
+    uint64_t check = 0;
+    for (uint64_t k = 0; k < total; k++) {
+        check += v[N - 1];
+        s.nextPermutation(v);
+    }
+    auto t1 = chrono::steady_clock::now();
+    cout << "nextPermutation   : " << total << " perms in "
+         << chrono::duration<double, milli>(t1 - t0).count() << " ms (check " << check << ")" << endl;
+
+    vector<uint64_t> buf(4096);
+    for (auto mode : {PackedPermutations::LEXICOGRAPHIC, PackedPermutations::HEAP}) {
+        t0 = chrono::steady_clock::now();
+        PackedPermutations gen(N, mode);
+        uint64_t count = 0;
+        check = 0;
+        for (size_t got; (got = gen.nextBatch(buf.data(), buf.size())) > 0; count += got)
+            for (size_t k = 0; k < got; k++) check += buf[k] >> (4 * (N - 1));
+        t1 = chrono::steady_clock::now();
+
+        cout << (mode == PackedPermutations::HEAP ? "Packed Heap       : " : "Packed lexico     : ")
+             << count << " perms in "
+             << chrono::duration<double, milli>(t1 - t0).count() << " ms (check " << check << ")" << endl;
+    }
+
+    // Parallel search: weighted displacement score over 10! orders
+    vector<int> jobs = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    auto cost = [](const vector<int>& p, bool&) {
+        double c = 0;
+        for (int i = 0; i < (int)p.size(); i++) c += (i + 1) * abs(p[i] - (9 - i)) + (p[i] & i);
+        return c;
+    };
+
+    ParallelPermutationSearch search;
+    PermSearchResult all = search.run(jobs, cost);
+    cout << "Searched " << all.visited << " perms: min " << all.minScore
+         << " (rank " << all.minRank << "), max " << all.maxScore << endl;
+
+    // Only orders whose first two jobs are increasing
+    search.pruneDepth = 2;
+    PermSearchResult pruned = search.run(jobs, cost, [](const vector<int>& p, int len) {
+        return len < 2 || p[0] < p[1];
+    });
+    cout << "Pruned search     : " << pruned.visited << " perms, min " << pruned.minScore << endl;
+
+    // Stop at the first order that costs less than 100
+    PermSearchResult early = ParallelPermutationSearch().run(jobs, [&](const vector<int>& p, bool& halt) {
+        double c = cost(p, halt);
+        halt = c < 100;
+        return c;
+    });
+    cout << "Early stop        : " << early.visited << " perms, found " << early.minScore
+         << (early.stopped ? " (stopped)" : "") << endl;
+
+    // Repeated values
+    vector<int> multi = {2, 1, 3, 1, 2};
+    cout << "Distinct orders of 2 1 3 1 2: " << MultisetPermutations::count(multi)
+         << ", rank " << MultisetPermutations::rank(multi)
+         << ", remaining " << MultisetPermutations::remaining(multi) << endl;
+
+    cout << "Order #17        : ";
+    for (int x : MultisetPermutations::unrank(17, multi)) cout << x << " ";
+    cout << endl;
+
+    cout << "Skip prefix 2 1  : ";
+    MultisetPermutations::skipPrefix(multi, 2);
+    for (int x : multi) cout << x << " ";
+    cout << endl;
+
     return 0;
 }
\ No newline at end of file
@@ -1,5 +1,12 @@
 #include <iostream>
 #include <vector>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <algorithm>
+#include <chrono>
+#include <random>
 using namespace std;
 
 /*
@@ -85,6 +92,7 @@ public:
     -------------------------------------------------------------
     If asked to print ONLY the last row:
         We can store only 1 row at a time → O(numRows)
+        (see pascalRow64 / pascalRowBig / PascalRowStream below)
 
     But since this problem REQUIRES returning ALL rows,
     full O(n^2) space is mandatory.
@@ -93,6 +101,477 @@ public:
 */
 
 
+/*
+    -------------------------------------------------------------
+    LARGE TABLES: FLAT STORAGE + WIDE / MODULAR COEFFICIENTS
+    -------------------------------------------------------------
+    Problems with Solution::generate for big numRows:
+        - int overflows after row 34 (C(34,17) > 2^31)
+        - one heap allocation per row, and push_back(row) copies it
+
+    FIX:
+    1. ONE contiguous buffer of n(n+1)/2 slots.
+           row i starts at offset(i) = i(i+1)/2
+       Row i-1 and row i are neighbours in memory, so the update
+           cur[j] = prev[j-1] + prev[j]
+       is a straight loop over two contiguous arrays.
+       For ModArith the row is processed in blocks of 8 lanes copied
+       through local arrays (fixed trip count, no aliasing) with a
+       branchless mod add, so GCC's SLP vectoriser emits SIMD adds
+       even at plain -O2 on baseline SSE2 (checked with
+       -fopt-info-vec). U128Arith and BigArith carry between 64-bit
+       words and stay scalar under all flags.
+
+    2. Coefficient type is a policy ("Arith"):
+           ModArith      → C(n,k) mod p          (4 bytes / slot)
+           U128Arith     → exact up to row 130   (16 bytes / slot)
+           BigArith<L>   → exact, L 64-bit limbs (exact up to row 64L)
+
+    3. PARALLEL BLOCKS (only where the arithmetic allows it):
+       Rows normally depend on the previous row → sequential.
+       But modulo a prime p > numRows, any row can be produced
+       DIRECTLY:
+           C(i,j) = C(i,j-1) * (i-j+1) * inv(j)   (mod p)
+       So the triangle is cut into blocks of rows; every thread seeds
+       the first row of its block directly and fills the rest with
+       additions, independent of other blocks.
+
+    TIME COMPLEXITY:  O(numRows^2) additions (+ O(numRows) per block seed)
+    SPACE COMPLEXITY: numRows(numRows+1)/2 slots, nothing else
+        e.g. 100K rows mod p → 5·10^9 slots × 4 bytes ≈ 20 GB
+*/
+
+struct ModArith {
+    using value_type = uint32_t;
+    static constexpr bool canSeedRow = true;
+    static constexpr bool simdAdd = true;
+
+    uint32_t p = 1000000007;        // prime, must be > numRows for seeding
+
+    uint32_t one() const { return 1; }
+
+    // Branchless: t = a + b - p lies in (-p, p) because p < 2^31,
+    // so add p back only when t is negative (sub, sra, and, add)
+    uint32_t add(uint32_t a, uint32_t b) const {
+        int32_t t = (int32_t)(a + b - p);
+        return (uint32_t)t + (p & (uint32_t)(t >> 31));
+    }
+
+    // Directly write row i: C(i,j) = C(i,j-1) * (i-j+1) / j  (mod p)
+    void seedRow(int i, uint32_t* out, const vector<uint32_t>& inv) const {
+        uint64_t c = 1;
+        out[0] = 1;
+        for (int j = 1; j <= i; j++) {
+            c = c * (uint32_t)(i - j + 1) % p * inv[j] % p;
+            out[j] = (uint32_t)c;
+        }
+    }
+
+    // inv[j] = j^-1 mod p for j = 1..n (linear-time recurrence)
+    vector<uint32_t> inverses(int n) const {
+        vector<uint32_t> inv(n + 1, 1);
+        for (int j = 2; j <= n; j++) {
+            inv[j] = (uint32_t)((uint64_t)(p - p / j) * inv[p % j] % p);
+        }
+        return inv;
+    }
+};
+
+struct U128Arith {
+    using value_type = unsigned __int128;
+    static constexpr bool canSeedRow = false;
+    static constexpr bool simdAdd = false;
+
+    value_type one() const { return 1; }
+    value_type add(value_type a, value_type b) const { return a + b; }
+};
+
+// Fixed-width multi-precision integer: L little-endian 64-bit limbs
+template <int L>
+struct BigNum {
+    uint64_t limb[L] = {};
+};
+
+template <int L>
+struct BigArith {
+    using value_type = BigNum<L>;
+    static constexpr bool canSeedRow = false;
+    static constexpr bool simdAdd = false;
+
+    value_type one() const {
+        value_type r;
+        r.limb[0] = 1;
+        return r;
+    }
+
+    value_type add(const value_type& a, const value_type& b) const {
+        value_type r;
+        uint64_t carry = 0;
+        for (int t = 0; t < L; t++) {
+            uint64_t s = a.limb[t] + carry;
+            carry = (s < carry);
+            r.limb[t] = s + b.limb[t];
+            carry += (r.limb[t] < s);
+        }
+        return r;
+    }
+};
+
+template <class Arith>
+class FlatPascalTriangle {
+public:
+    using T = typename Arith::value_type;
+
+    FlatPascalTriangle(int numRows, Arith arith = Arith())
+        : numRows(numRows), arith(arith), data(offset(numRows)) {}
+
+    static size_t offset(size_t i) { return i * (i + 1) / 2; }
+
+    const T& at(int i, int j) const { return data[offset(i) + j]; }
+    const T* row(int i) const { return data.data() + offset(i); }
+    int rows() const { return numRows; }
+
+    // Sequential: every row from the one above it
+    void generate() {
+        fillRows(0, numRows);
+    }
+
+    // Parallel blocks of rows (modular arithmetic only)
+    void generateParallel(unsigned threads = thread::hardware_concurrency(),
+                          int blockRows = 256) {
+        if constexpr (!Arith::canSeedRow) {
+            generate();
+        } else {
+            vector<uint32_t> inv = arith.inverses(max(numRows, 1));
+            int blocks = (numRows + blockRows - 1) / blockRows;
+            if (threads == 0) threads = 1;
+
+            vector<thread> pool;
+            for (unsigned t = 0; t < threads; t++) {
+                pool.emplace_back([&, t] {
+                    // Round-robin blocks → later (longer) rows spread evenly
+                    for (int blk = t; blk < blocks; blk += threads) {
+                        int first = blk * blockRows;
+                        int last = min(numRows, first + blockRows);
+
+                        arith.seedRow(first, data.data() + offset(first), inv);
+                        fillRows(first + 1, last);
+                    }
+                });
+            }
+            for (thread& th : pool) th.join();
+        }
+    }
+
+private:
+    int numRows;
+    Arith arith;
+    vector<T> data;
+
+    // Rows [first, last) from their predecessor row (row first-1 must exist)
+    void fillRows(int first, int last) {
+        for (int i = first; i < last; i++) {
+            T* __restrict cur = data.data() + offset(i);
+            const T* __restrict prev = cur - i;     // row i-1 starts i slots earlier
+
+            cur[0] = arith.one();
+            int j = 1;
+            if constexpr (Arith::simdAdd) {
+                // 8 lanes through locals → straight-line code GCC vectorises
+                for (; j + 8 <= i; j += 8) {
+                    T a[8], b[8];
+                    memcpy(a, prev + j - 1, sizeof a);
+                    memcpy(b, prev + j, sizeof b);
+                    for (int t = 0; t < 8; t++) a[t] = arith.add(a[t], b[t]);
+                    memcpy(cur + j, a, sizeof a);
+                }
+            }
+            for (; j < i; j++) {
+                cur[j] = arith.add(prev[j - 1], prev[j]);
+            }
+            cur[i] = arith.one();
+        }
+    }
+};
+
+
+/*
+    -------------------------------------------------------------
+    SINGLE C(n, k) QUERIES: FACTORIAL TABLES (+ LUCAS, + CRT)
+    -------------------------------------------------------------
+    When we only need individual coefficients, building the whole
+    triangle is O(n^2) for no reason. Instead precompute once:
+        fact[i]    = i!        (mod p)
+        invFact[i] = (i!)^-1   (mod p)
+    and then
+        C(n,k) = fact[n] * invFact[k] * invFact[n-k]   (mod p)
+    → two multiplications per query, O(1).
+
+    invFact is built backwards from ONE modular inverse:
+        invFact[N]   = fact[N]^(p-2)             (Fermat)
+        invFact[i-1] = invFact[i] * i
+
+    n BEYOND THE TABLE:
+        n >= p  → Lucas' theorem, digit by digit in base p:
+                  C(n,k) = Π C(n_i, k_i)   (mod p)
+        n <  p  but > table → multiplicative formula, O(min(k, n-k))
+
+    EXACT VALUES (several primes, CRT):
+        Run one engine per prime p_1..p_r and combine the residues
+        with Garner's algorithm. The result is exact whenever
+        C(n,k) < p_1 · p_2 · ... · p_r  (3 primes ≈ 2^90).
+
+    COMPLEXITY:
+        build  → O(N + log p)
+        query  → O(1) inside the table, O(log_p n) digits for Lucas
+        memory → 2 · N · 4 bytes per prime
+*/
+
+uint32_t modPow(uint64_t base, uint64_t e, uint32_t p) {
+    uint64_t r = 1;
+    base %= p;
+    while (e > 0) {
+        if (e & 1) r = r * base % p;
+        base = base * base % p;
+        e >>= 1;
+    }
+    return (uint32_t)r;
+}
+
+class BinomialModP {
+public:
+    // Table covers n in [0, min(maxN, p-1)]
+    BinomialModP(uint32_t p, uint32_t maxN) : p(p) {
+        uint32_t N = min<uint64_t>(maxN, p - 1);
+
+        fact.resize(N + 1);
+        invFact.resize(N + 1);
+
+        fact[0] = 1;
+        for (uint32_t i = 1; i <= N; i++) fact[i] = (uint64_t)fact[i - 1] * i % p;
+
+        invFact[N] = modPow(fact[N], p - 2, p);
+        for (uint32_t i = N; i > 0; i--) invFact[i - 1] = (uint64_t)invFact[i] * i % p;
+    }
+
+    uint32_t prime() const { return p; }
+
+    uint32_t query(uint64_t n, uint64_t k) const {
+        if (k > n) return 0;
+
+        // Lucas: split into base-p digits
+        if (n >= p) {
+            return (uint64_t)query(n / p, k / p) * query(n % p, k % p) % p;
+        }
+
+        if (n < fact.size()) {
+            return (uint64_t)fact[n] * invFact[k] % p * invFact[n - k] % p;
+        }
+
+        return slowQuery(n, k);
+    }
+
+    // Batch API: out[i] = C(n[i], k[i]) mod p
+    void queryBatch(const uint64_t* n, const uint64_t* k, uint32_t* out, size_t count) const {
+        for (size_t i = 0; i < count; i++) out[i] = query(n[i], k[i]);
+    }
+
+private:
+    uint32_t p;
+    vector<uint32_t> fact, invFact;
+
+    // n < p but outside the table: C(n,k) = Π (n-k+i) / i
+    uint32_t slowQuery(uint64_t n, uint64_t k) const {
+        k = min(k, n - k);
+        uint64_t num = 1, den = 1;
+        for (uint64_t i = 1; i <= k; i++) {
+            num = num * ((n - k + i) % p) % p;
+            den = den * (i % p) % p;
+        }
+        return (uint64_t)num * modPow(den, p - 2, p) % p;
+    }
+};
+
+class BinomialCRT {
+public:
+    BinomialCRT(const vector<uint32_t>& primes, uint32_t maxN) {
+        for (uint32_t q : primes) engines.emplace_back(q, maxN);
+    }
+
+    // Exact C(n,k) as long as it is below the product of the primes
+    unsigned __int128 query(uint64_t n, uint64_t k) const {
+        unsigned __int128 result = 0, modulus = 1;
+
+        // Garner: result ≡ r_i (mod p_i), extended one prime at a time
+        for (const BinomialModP& e : engines) {
+            uint32_t q = e.prime();
+            uint32_t r = e.query(n, k);
+
+            uint32_t cur = (uint32_t)(result % q);
+            uint32_t m = (uint32_t)(modulus % q);
+
+            // t = (r - result) / modulus   (mod q)
+            uint64_t t = (uint64_t)((r + q - cur) % q) * modPow(m, q - 2, q) % q;
+
+            result += modulus * t;
+            modulus *= q;
+        }
+        return result;
+    }
+
+private:
+    vector<BinomialModP> engines;
+};
+
+
+
+/*
+    -------------------------------------------------------------
+    SINGLE ROW n — MULTIPLICATIVE FORMULA, O(n)
+    -------------------------------------------------------------
+    Row n alone does not need rows 0..n-1:
+        C(n, 0) = 1
+        C(n, j) = C(n, j-1) * (n - j + 1) / j
+    The division is always exact (the result is an integer), as long
+    as we multiply FIRST and divide second.
+
+        pascalRow64(n)  → exact in uint64_t for n <= 67
+                          (product done in 128 bits, so no overflow)
+        pascalRowBig(n) → exact for any n (BigUint limbs)
+
+    STREAMING (whole triangle, O(n) memory):
+        PascalRowStream emits row 0, 1, 2, ... into ONE caller buffer,
+        updating it in place from right to left:
+            buf[j] = buf[j] + buf[j-1]     for j = i-1 .. 1
+        so a pipeline can consume rows one at a time without ever
+        holding the O(n^2) triangle. Works with any Arith policy above.
+
+    TIME COMPLEXITY:  O(n) per row (× limb count for BigUint)
+    SPACE COMPLEXITY: O(n)
+*/
+
+vector<uint64_t> pascalRow64(int n) {
+    vector<uint64_t> row(n + 1);
+    row[0] = 1;
+
+    for (int j = 1; j <= n; j++) {
+        unsigned __int128 c = (unsigned __int128)row[j - 1] * (n - j + 1);
+        row[j] = (uint64_t)(c / j);
+    }
+    return row;
+}
+
+// Arbitrary-size unsigned integer, little-endian 32-bit limbs
+struct BigUint {
+    vector<uint32_t> limb{1};
+
+    void mulSmall(uint32_t m) {
+        uint64_t carry = 0;
+        for (uint32_t& x : limb) {
+            uint64_t cur = (uint64_t)x * m + carry;
+            x = (uint32_t)cur;
+            carry = cur >> 32;
+        }
+        if (carry) limb.push_back((uint32_t)carry);
+    }
+
+    // Returns the remainder (0 when the division is exact)
+    uint32_t divSmall(uint32_t d) {
+        uint64_t rem = 0;
+        for (size_t t = limb.size(); t-- > 0; ) {
+            uint64_t cur = (rem << 32) | limb[t];
+            limb[t] = (uint32_t)(cur / d);
+            rem = cur % d;
+        }
+        while (limb.size() > 1 && limb.back() == 0) limb.pop_back();
+        return (uint32_t)rem;
+    }
+
+    string toString() const {
+        BigUint v = *this;
+        string s;
+        do {
+            s += char('0' + v.divSmall(10));
+        } while (v.limb.size() > 1 || v.limb[0] != 0);
+        return string(s.rbegin(), s.rend());
+    }
+};
+
+vector<BigUint> pascalRowBig(int n) {
+    vector<BigUint> row(n + 1);
+
+    // Symmetric → only compute the left half, mirror the rest
+    for (int j = 1; j <= n / 2; j++) {
+        row[j] = row[j - 1];
+        row[j].mulSmall(n - j + 1);
+        row[j].divSmall(j);
+    }
+    for (int j = n / 2 + 1; j <= n; j++) row[j] = row[n - j];
+
+    return row;
+}
+
+template <class Arith>
+class PascalRowStream {
+public:
+    using T = typename Arith::value_type;
+
+    explicit PascalRowStream(Arith arith = Arith()) : arith(arith) {}
+
+    /*
+        Writes the next row into buf (capacity >= rowIndex + 1) and
+        returns its index. buf must still hold the previous row, i.e.
+        pass the SAME buffer on every call.
+    */
+    int next(T* buf) {
+        int i = current++;
+
+        buf[i] = arith.one();
+        for (int j = i - 1; j >= 1; j--) {
+            buf[j] = arith.add(buf[j], buf[j - 1]);
+        }
+        buf[0] = arith.one();
+
+        return i;
+    }
+
+private:
+    Arith arith;
+    int current = 0;
+};
+
+
+// Decimal printing helpers for the wide coefficient types
+string toDecimal(unsigned __int128 v) {
+    if (v == 0) return "0";
+    string s;
+    while (v > 0) {
+        s += char('0' + (int)(v % 10));
+        v /= 10;
+    }
+    return string(s.rbegin(), s.rend());
+}
+
+template <int L>
+string toDecimal(BigNum<L> v) {
+    string s;
+    bool zero = false;
+    while (!zero) {
+        // Divide by 10 limb by limb (most significant first)
+        unsigned __int128 rem = 0;
+        zero = true;
+        for (int t = L - 1; t >= 0; t--) {
+            unsigned __int128 cur = (rem << 64) | v.limb[t];
+            v.limb[t] = (uint64_t)(cur / 10);
+            rem = cur % 10;
+            if (v.limb[t]) zero = false;
+        }
+        s += char('0' + (int)rem);
+    }
+    return string(s.rbegin(), s.rend());
+}
+
+
 int main() {
     // Example usage:
     int numRows = 5;
@@ -107,5 +586,68 @@ int main() {
         cout << endl;
     }
 
+    // Flat tables: modular (parallel blocks), 128-bit and 4-limb exact
+    FlatPascalTriangle<ModArith> modTri(2000);
+    modTri.generateParallel();
+    cout << "C(1999, 1000) mod 1e9+7 = " << modTri.at(1999, 1000) << endl;
+
+    FlatPascalTriangle<U128Arith> wideTri(101);
+    wideTri.generate();
+    cout << "C(100, 50)  = " << toDecimal(wideTri.at(100, 50)) << endl;
+
+    FlatPascalTriangle<BigArith<4>> bigTri(201);
+    bigTri.generate();
+    cout << "C(200, 100) = " << toDecimal(bigTri.at(200, 100)) << endl;
+
+    // Factorial-table query engine: build time + query throughput
+    const uint32_t maxN = 10'000'000;
+    const size_t Q = 10'000'000;
+
+    auto t0 = chrono::steady_clock::now();
+    BinomialModP engine(1000000007, maxN);
+    auto t1 = chrono::steady_clock::now();
+
+    mt19937_64 rng(7);
+    vector<uint64_t> qn(Q), qk(Q);
+    for (size_t i = 0; i < Q; i++) {
+        qn[i] = rng() % maxN;
+        qk[i] = rng() % (qn[i] + 1);
+    }
+
+    vector<uint32_t> answers(Q);
+    auto t2 = chrono::steady_clock::now();
+    engine.queryBatch(qn.data(), qk.data(), answers.data(), Q);
+    auto t3 = chrono::steady_clock::now();
+
+    double buildMs = chrono::duration<double, milli>(t1 - t0).count();
+    double querySec = chrono::duration<double>(t3 - t2).count();
+
+    cout << "Table build (n <= 1e7)   : " << buildMs << " ms" << endl;
+    cout << "Batch queries            : " << Q / querySec / 1e6 << " M/s" << endl;
+
+    // Lucas (small prime) and CRT (exact) paths
+    BinomialModP small(13, 100);
+    cout << "C(1000, 300) mod 13 (Lucas) = " << small.query(1000, 300) << endl;
+
+    BinomialCRT exact({1000000007, 998244353, 1000000009}, 200);
+    cout << "C(90, 45) via CRT           = " << toDecimal(exact.query(90, 45)) << endl;
+
+    // Single rows and streaming
+    vector<uint64_t> r67 = pascalRow64(67);
+    cout << "Row 67, middle (64-bit)     = " << r67[33] << endl;
+
+    vector<BigUint> r300 = pascalRowBig(300);
+    cout << "Row 300, middle (BigUint)   = " << r300[150].toString() << endl;
+
+    PascalRowStream<U128Arith> stream;
+    vector<unsigned __int128> buf(6);
+
+    cout << "Streamed rows:" << endl;
+    for (int r = 0; r < 6; r++) {
+        int i = stream.next(buf.data());
+        for (int j = 0; j <= i; j++) cout << toDecimal(buf[j]) << " ";
+        cout << endl;
+    }
+
     return 0;
 }
@@ -1,6 +1,10 @@
 #include <iostream>
 #include <vector>
 #include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <thread>
 using namespace std;
 
 /*
@@ -109,6 +113,558 @@ public:
 
 
 
+/*
+    ============================================================================
+    APPROACH 3 — Merge Engine (Galloping + Branchless + Parallel Merge-Path)
+    ============================================================================
+    Same contract as Approach 2: result ends up IN nums1.
+
+    IDEA:
+        Like Approach 2, the sequential kernels fill nums1 from the BACK,
+        in place: the write position k never falls behind the next
+        unread nums1 element, and nums1 elements that are already in
+        their final slot are never touched.
+
+        Pick a kernel based on the shapes of the inputs:
+
+        (a) GALLOPING — one input much larger than the other
+            For every element x of the SMALL array (back to front),
+            exponential-search (1, 2, 4, 8, ... then binary search)
+            backwards over the LARGE array for the block that sorts
+            after x, and move that whole block with one memmove/memcpy.
+                Cost: O(small * log(large / small) + moved)
+            If nums2 sorts entirely after nums1, every search stops at
+            its first probe and no nums1 element moves → O(n).
+
+        (b) BRANCHLESS — balanced inputs
+            The usual "if (a < b)" is a coin flip for random data and
+            the branch predictor loses. We compute both candidates and
+            advance pointers arithmetically (cmov instead of a jump),
+            which the compiler turns into straight-line code.
+
+        (c) PARALLEL MERGE-PATH — very large, balanced outputs
+            Output position d splits the inputs at some (i, d - i).
+            A binary search on each "diagonal" finds that split, so
+            T threads each merge one independent slice of the output.
+            Each slice then uses a forward version of (a) or (b).
+            Skewed inputs stay on the sequential galloping path, where
+            the moves, not the comparisons, dominate.
+
+    TIME COMPLEXITY:  O(m + n) work, O((m + n) / T + log(m + n)) span
+                      O(small * log(large / small) + moved) when galloping,
+                      i.e. O(n) when nums2 sorts after nums1
+    SPACE COMPLEXITY: O(1) sequential,
+                      O(m) scratch copy of nums1 for the parallel path
+
+    NOTE:
+        Ties keep nums1's element first (stable), like Approach 2's
+        output order.
+*/
+class MergeEngineSolution {
+public:
+    size_t gallopRatio = 16;           // size ratio that switches to galloping
+    size_t parallelThreshold = 1 << 20; // output size that enables threads
+    unsigned threads = thread::hardware_concurrency();
+
+    void merge(vector<int>& nums1, int m, vector<int>& nums2, int n) {
+
+        if (n == 0) return;
+
+        size_t total = (size_t)m + n;
+        bool skewed = skewedSizes(m, n);
+
+        if (!skewed && total >= parallelThreshold && threads > 1) {
+            // Scratch copy of nums1's valid part → every slice writes
+            // to a disjoint output range without overwriting inputs
+            vector<int> a(nums1.begin(), nums1.begin() + m);
+            parallelMerge(a.data(), m, nums2.data(), n, nums1.data());
+            return;
+        }
+
+        // Sequential: fill nums1 from the back, in place
+        if (skewed)
+            gallopMergeBack(nums1.data(), m, nums2.data(), n);
+        else
+            branchlessMergeBack(nums1.data(), m, nums2.data(), n);
+    }
+
+private:
+    bool skewedSizes(size_t na, size_t nb) const {
+        return na >= nb * gallopRatio || nb >= na * gallopRatio;
+    }
+
+    /*
+        IN-PLACE KERNELS (sequential path)
+        a[0..na) holds nums1's valid part, a[na..na+nb) is free space.
+        Output position k is filled from the back; it always stays at
+        or ahead of the next unread a element, so nothing is clobbered
+        and elements of a that are already in place are never touched.
+    */
+    void branchlessMergeBack(int* a, size_t na, const int* b, size_t nb) {
+        size_t i = na, j = nb, k = na + nb;
+
+        while (i > 0 && j > 0) {
+            int x = a[i - 1], y = b[j - 1];
+            bool takeA = y < x;          // strict → nums1 stays first on ties
+
+            a[--k] = takeA ? x : y;
+            i -= takeA;
+            j -= !takeA;
+        }
+
+        // Leftover a's are already in place; leftover b's fill the front
+        memcpy(a, b, j * sizeof(int));
+    }
+
+    // Smallest p in [0, end) with pred(arr[q]) true for all q in [p, end),
+    // searched backwards 1, 2, 4, ... from end (pred true on a suffix).
+    template <class Pred>
+    static size_t gallopBack(const int* arr, size_t end, Pred pred) {
+        size_t step = 1, lo = end, hi = end;   // pred holds on [hi, end)
+
+        while (lo > 0 && pred(arr[lo - 1])) {
+            hi = lo - 1;
+            lo = end > step ? end - step : 0;
+            step *= 2;
+        }
+        lo = min(lo, hi);
+
+        // Binary search inside the last jump window
+        return partition_point(arr + lo, arr + hi,
+                               [&](int v) { return !pred(v); }) - arr;
+    }
+
+    void gallopMergeBack(int* a, size_t na, const int* b, size_t nb) {
+        size_t i = na, j = nb, k = na + nb;
+
+        if (na >= nb) {
+            // a is large: for each b[j] (from the back), shift only the
+            // a's that are > b[j]. If b sorts after a, nothing moves.
+            while (j > 0) {
+                int x = b[--j];
+                size_t p = gallopBack(a, i, [x](int v) { return v > x; });
+
+                k -= i - p;
+                memmove(a + k, a + p, (i - p) * sizeof(int));
+                i = p;
+                a[--k] = x;
+            }
+            // a[0..i) is already in place
+        } else {
+            // b is large: for each a[i] (from the back), copy the b's
+            // that are >= a[i], then a[i] itself
+            while (i > 0) {
+                int x = a[--i];
+                size_t p = gallopBack(b, j, [x](int v) { return v >= x; });
+
+                k -= j - p;
+                memcpy(a + k, b + p, (j - p) * sizeof(int));
+                j = p;
+                a[--k] = x;
+            }
+            memcpy(a, b, j * sizeof(int));
+        }
+    }
+
+    /*
+        FORWARD KERNELS (parallel slices)
+        Merge a[0..na) and b[0..nb) into a separate out[0..na+nb).
+    */
+    void mergeKernel(const int* a, size_t na, const int* b, size_t nb, int* out) {
+        if (skewedSizes(na, nb))
+            gallopMerge(a, na, b, nb, out);
+        else
+            branchlessMerge(a, na, b, nb, out);
+    }
+
+    void branchlessMerge(const int* a, size_t na, const int* b, size_t nb, int* out) {
+        size_t i = 0, j = 0, k = 0;
+
+        while (i < na && j < nb) {
+            int x = a[i], y = b[j];
+            bool takeB = y < x;          // strict → nums1 wins ties
+
+            out[k++] = takeB ? y : x;
+            j += takeB;
+            i += !takeB;
+        }
+
+        // Leftovers (memmove: a's tail may overlap out)
+        memmove(out + k, a + i, (na - i) * sizeof(int));
+        k += na - i;
+        memmove(out + k, b + j, (nb - j) * sizeof(int));
+    }
+
+    // First index p in [from, n) with pred(arr[p]) false, searched 1, 2, 4, ...
+    template <class Pred>
+    static size_t gallop(const int* arr, size_t from, size_t n, Pred pred) {
+        size_t step = 1, lo = from, hi = from;
+
+        while (hi < n && pred(arr[hi])) {
+            lo = hi + 1;
+            hi = from + step;
+            step *= 2;
+        }
+        hi = min(hi, n);
+
+        // Binary search inside the last jump window
+        return partition_point(arr + lo, arr + hi, pred) - arr;
+    }
+
+    void gallopMerge(const int* a, size_t na, const int* b, size_t nb, int* out) {
+        size_t i = 0, j = 0, k = 0;
+
+        if (na >= nb) {
+            // a is large: for each b[j], copy all a's that are <= b[j]
+            for (; j < nb; j++) {
+                int x = b[j];
+                size_t p = gallop(a, i, na, [x](int v) { return v <= x; });
+
+                memmove(out + k, a + i, (p - i) * sizeof(int));
+                k += p - i;
+                i = p;
+                out[k++] = x;
+            }
+            memmove(out + k, a + i, (na - i) * sizeof(int));
+        } else {
+            // b is large: for each a[i], copy all b's that are < a[i]
+            for (; i < na; i++) {
+                int x = a[i];
+                size_t p = gallop(b, j, nb, [x](int v) { return v < x; });
+
+                memmove(out + k, b + j, (p - j) * sizeof(int));
+                k += p - j;
+                j = p;
+                out[k++] = x;
+            }
+            memmove(out + k, b + j, (nb - j) * sizeof(int));
+        }
+    }
+
+    /*
+        Merge-path split: how many of the first d outputs come from a.
+        Smallest i such that a[i] > b[d - i - 1] (a wins ties).
+    */
+    static size_t mergePathSplit(const int* a, size_t na, const int* b, size_t nb, size_t d) {
+        size_t lo = d > nb ? d - nb : 0;
+        size_t hi = min(d, na);
+
+        while (lo < hi) {
+            size_t mid = (lo + hi) / 2;
+            if (a[mid] <= b[d - mid - 1]) lo = mid + 1;
+            else hi = mid;
+        }
+        return lo;
+    }
+
+    void parallelMerge(const int* a, size_t na, const int* b, size_t nb, int* out) {
+        size_t total = na + nb;
+        size_t chunk = (total + threads - 1) / threads;
+
+        vector<thread> pool;
+
+        for (unsigned t = 0; t < threads; t++) {
+            size_t d0 = min(total, t * chunk);
+            size_t d1 = min(total, d0 + chunk);
+            if (d0 == d1) break;
+
+            pool.emplace_back([=] {
+                size_t i0 = mergePathSplit(a, na, b, nb, d0);
+                size_t i1 = mergePathSplit(a, na, b, nb, d1);
+                size_t j0 = d0 - i0, j1 = d1 - i1;
+
+                mergeKernel(a + i0, i1 - i0, b + j0, j1 - j0, out + d0);
+            });
+        }
+        for (thread& th : pool) th.join();
+    }
+};
+
+
+
+
+/*
+    ============================================================================
+    APPROACH 4 — K-Way Merge of Many Sorted Runs (Loser Tree)
+    ============================================================================
+    PROBLEM VARIANT:
+        Merge k sorted runs (k in the thousands) into one sorted output.
+        Calling Approach 2 pairwise re-copies the growing result every
+        time → O(n * k) moves, or O(n log k) with heavy copying.
+
+    IDEA — TOURNAMENT (LOSER) TREE:
+        Leaves = current head of every run.
+        Each internal node remembers the LOSER of the match played there;
+        the overall winner (smallest head) sits in tree[0].
+
+        Pop winner w → advance run w → replay ONLY the path from leaf w
+        to the root, comparing against the stored losers.
+            → exactly log2(k) comparisons per output element
+            → no sibling lookups (cheaper than a binary heap)
+            → tree is a flat int array of size k (cache friendly)
+
+    BUFFERED CURSORS:
+        In-memory runs are read straight from their vector (zero copy).
+        File runs are read sequentially with fread() into a fixed buffer,
+        so k runs need only k * bufferInts ints of memory. Runs are never
+        seeked, so pipes and sockets work too; a failed read is reported.
+
+    OUTPUT:
+        Any sink called once per value, strictly forward: a preallocated
+        array (in-memory runs, size known) or a growing vector (files).
+        The "dedup" flag drops values equal to the previous output.
+
+    TIME COMPLEXITY:  O(N log k)   (N = total elements)
+    SPACE COMPLEXITY: O(k) tree + O(k * bufferInts) for file runs
+*/
+class KWayMergeSolution {
+public:
+    struct RunCursor {
+        const int* cur = nullptr;
+        const int* end = nullptr;
+
+        FILE* file = nullptr;      // null → in-memory run
+        vector<int> buffer;
+        bool failed = false;       // read error or truncated run
+
+        // Current head is valid? (refills from file when exhausted)
+        bool valid() {
+            if (cur < end) return true;
+            if (!file || failed) return false;
+
+            // Read bytes: fread only stops short at EOF or on an error,
+            // so a leftover partial int means a truncated run
+            size_t bytes = fread(buffer.data(), 1, buffer.size() * sizeof(int), file);
+            if (ferror(file) || bytes % sizeof(int) != 0) failed = true;
+
+            cur = buffer.data();
+            end = cur + bytes / sizeof(int);
+            return cur < end;
+        }
+    };
+
+    // Merge already-open cursors into out; returns number of ints written
+    size_t merge(vector<RunCursor>& runs, int* out, bool dedup = false) {
+        size_t written = 0;
+        mergeInto(runs, [&](int v) { out[written++] = v; }, dedup);
+        return written;
+    }
+
+    // Same, but every output value goes to emit(int)
+    template <class Sink>
+    size_t mergeInto(vector<RunCursor>& runs, Sink emit, bool dedup = false) {
+
+        int k = runs.size();
+        if (k == 0) return 0;
+
+        vector<char> done(k);
+        for (int i = 0; i < k; i++) done[i] = !runs[i].valid();
+
+        // a beats b? (exhausted runs always lose; ties → lower run index)
+        auto beats = [&](int a, int b) {
+            if (done[a]) return false;
+            if (done[b]) return true;
+            int x = *runs[a].cur, y = *runs[b].cur;
+            return x < y || (x == y && a < b);
+        };
+
+        // Build: play every match bottom-up, store losers in tree[1..k-1]
+        vector<int> tree(k), winner(2 * k);
+        for (int i = 0; i < k; i++) winner[k + i] = i;
+
+        for (int node = k - 1; node >= 1; node--) {
+            int l = winner[2 * node], r = winner[2 * node + 1];
+            bool lw = beats(l, r);
+            winner[node] = lw ? l : r;
+            tree[node] = lw ? r : l;
+        }
+        tree[0] = winner[1];
+
+        size_t written = 0;
+        int last = 0;
+
+        while (!done[tree[0]]) {
+            int w = tree[0];
+            int value = *runs[w].cur++;
+
+            if (!dedup || written == 0 || last != value) {
+                emit(value);
+                last = value;
+                written++;
+            }
+
+            done[w] = !runs[w].valid();
+
+            // Replay the path from leaf w to the root
+            for (int node = (w + k) / 2; node > 0; node /= 2) {
+                if (beats(tree[node], w)) swap(tree[node], w);
+            }
+            tree[0] = w;
+        }
+
+        return written;
+    }
+
+    // In-memory runs → freshly allocated output of the exact total size
+    vector<int> mergeRuns(const vector<vector<int>>& runs, bool dedup = false) {
+
+        vector<RunCursor> cursors(runs.size());
+        size_t total = 0;
+
+        for (size_t i = 0; i < runs.size(); i++) {
+            cursors[i].cur = runs[i].data();
+            cursors[i].end = runs[i].data() + runs[i].size();
+            total += runs[i].size();
+        }
+
+        vector<int> out(total);
+        out.resize(merge(cursors, out.data(), dedup));
+        return out;
+    }
+
+    // File runs (raw binary ints, read sequentially from the current
+    // position). Output is appended to out. Returns false if any run had
+    // a read error; the merged output then stops short for that run.
+    bool mergeFiles(const vector<FILE*>& files, vector<int>& out, bool dedup = false,
+                    size_t bufferInts = 1 << 14) {
+
+        vector<RunCursor> cursors(files.size());
+        for (size_t i = 0; i < files.size(); i++) {
+            cursors[i].file = files[i];
+            cursors[i].buffer.resize(max<size_t>(bufferInts, 1));
+        }
+
+        mergeInto(cursors, [&](int v) { out.push_back(v); }, dedup);
+
+        for (const RunCursor& c : cursors) {
+            if (c.failed) return false;
+        }
+        return true;
+    }
+};
+
+
+
+
+/*
+    ============================================================================
+    APPROACH 5 — Lazy Merged View (No Materialization)
+    ============================================================================
+    PROBLEM VARIANT:
+        Many callers only want the first few merged items, or a single
+        order statistic (k-th smallest, median). Writing all m + n
+        elements into nums1 is wasted work for them.
+
+    IDEA:
+        Keep only two read-only pointers into the inputs and expose:
+
+        1. A FORWARD ITERATOR running the same two-pointer logic as
+           Approach 2 (front-to-back, nums1 first on ties).
+           Taking the first k items costs O(k), memory O(1).
+
+        2. kth(k) — the k-th smallest (0-indexed) WITHOUT merging.
+           The first k+1 merged items take some i from a and
+           (k+1 - i) from b. Binary search i on the SMALLER range:
+                valid split ⇔ a[i-1] <= b[j]  and  b[j-1] < a[i]
+           Answer = max(a[i-1], b[j-1]).
+
+        3. median() — one or two kth() calls.
+
+    TIME COMPLEXITY:
+        iterate prefix of k → O(k)
+        kth / median        → O(log(min(m, n)))
+    SPACE COMPLEXITY: O(1)
+*/
+class MergedView {
+public:
+    MergedView(const int* a, size_t na, const int* b, size_t nb)
+        : a(a), na(na), b(b), nb(nb) {}
+
+    // Convenience: same argument shape as merge(nums1, m, nums2, n)
+    MergedView(const vector<int>& nums1, int m, const vector<int>& nums2, int n)
+        : MergedView(nums1.data(), m, nums2.data(), n) {}
+
+    class Iterator {
+    public:
+        using iterator_category = forward_iterator_tag;
+        using value_type = int;
+        using difference_type = ptrdiff_t;
+        using pointer = const int*;
+        using reference = const int&;
+
+        Iterator(const MergedView* v, size_t i, size_t j) : v(v), i(i), j(j) {}
+
+        const int& operator*() const { return fromA() ? v->a[i] : v->b[j]; }
+
+        Iterator& operator++() {
+            if (fromA()) i++;
+            else j++;
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        bool operator==(const Iterator& o) const { return i == o.i && j == o.j; }
+        bool operator!=(const Iterator& o) const { return !(*this == o); }
+
+    private:
+        const MergedView* v;
+        size_t i, j;
+
+        // Two-pointer choice: take a unless a is exhausted or b is smaller
+        bool fromA() const {
+            return j == v->nb || (i < v->na && v->a[i] <= v->b[j]);
+        }
+    };
+
+    Iterator begin() const { return Iterator(this, 0, 0); }
+    Iterator end() const { return Iterator(this, na, nb); }
+
+    size_t size() const { return na + nb; }
+
+    // k-th smallest element (0-indexed), k < size()
+    int kth(size_t k) const {
+        size_t take = k + 1;
+
+        // i = how many of the first "take" items come from a
+        size_t lo = take > nb ? take - nb : 0;
+        size_t hi = min(take, na);
+
+        while (lo < hi) {
+            size_t i = (lo + hi) / 2;
+            size_t j = take - i;
+
+            if (a[i] <= b[j - 1]) lo = i + 1;   // a[i] also belongs in the prefix
+            else hi = i;
+        }
+
+        size_t i = lo, j = take - lo;
+
+        if (i == 0) return b[j - 1];
+        if (j == 0) return a[i - 1];
+        return max(a[i - 1], b[j - 1]);
+    }
+
+    double median() const {
+        size_t total = size();
+        if (total % 2 == 1) return kth(total / 2);
+        return (kth(total / 2 - 1) + (double)kth(total / 2)) / 2.0;
+    }
+
+private:
+    const int* a;
+    size_t na;
+    const int* b;
+    size_t nb;
+};
+
+
+
+
 /*
     ============================================================================
     MAIN FUNCTION — Demonstration
@@ -136,7 +692,51 @@ int main() {
 
     cout << "After Optimal Two-Pointer Approach:\n";
     for (int x : arr2) cout << x << " ";
+    cout << "\n\n";
+
+    // Approach 3 (small inputs → sequential branchless kernel)
+    MergeEngineSolution sol3;
+    vector<int> arr3 = nums1;
+    sol3.merge(arr3, 3, nums2, 3);
+
+    cout << "After Merge Engine Approach:\n";
+    for (int x : arr3) cout << x << " ";
+    cout << "\n\n";
+
+    // Approach 4 — k sorted runs, in memory and from files
+    KWayMergeSolution sol4;
+    vector<vector<int>> runs = {{1, 4, 9}, {2, 4, 6, 8}, {0, 9}, {}, {3, 4}};
+
+    cout << "After K-Way Merge:\n";
+    for (int x : sol4.mergeRuns(runs)) cout << x << " ";
     cout << "\n";
 
+    vector<FILE*> files;
+    for (auto& r : runs) {
+        FILE* f = tmpfile();
+        if (!r.empty()) fwrite(r.data(), sizeof(int), r.size(), f);
+        rewind(f);
+        files.push_back(f);
+    }
+
+    vector<int> fromFiles;
+    bool ok = sol4.mergeFiles(files, fromFiles, true, 2);
+
+    cout << "After K-Way Merge (files, dedup)" << (ok ? "" : " [read error]") << ":\n";
+    for (int x : fromFiles) cout << x << " ";
+    cout << "\n";
+
+    for (FILE* f : files) fclose(f);
+
+    // Approach 5 — lazy view over the original (unmerged) inputs
+    MergedView view(nums1, 3, nums2, 3);
+
+    cout << "\nFirst 4 items of Merged View:\n";
+    auto it = view.begin();
+    for (int c = 0; c < 4 && it != view.end(); c++, ++it) cout << *it << " ";
+    cout << "\n";
+
+    cout << "kth(4) = " << view.kth(4) << ", median = " << view.median() << "\n";
+
     return 0;
 }